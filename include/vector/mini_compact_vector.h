@@ -0,0 +1,536 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "mini_iterator.h"
+
+namespace mini_stl {
+
+// compact_vector：对象本身只保存一个指针
+// size / capacity 以 SizeType 存放在堆块头部，分配器通过
+// [[no_unique_address]] 存放，无状态分配器不占空间
+template <typename T, typename SizeType = std::uint32_t,
+          typename Allocator = std::allocator<T>>
+class compact_vector {
+    static_assert(std::is_unsigned_v<SizeType>,
+                  "compact_vector: SizeType must be an unsigned integer");
+
+  public:
+    using value_type = T;
+    using size_type = SizeType;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using reference = T &;
+    using const_reference = const T &;
+    using iterator = mini_stl::vector_iterator<T>;
+    using const_iterator = mini_stl::vector_const_iterator<T>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+    using allocator_type = Allocator;
+
+    // 默认构造函数：不分配内存
+    compact_vector() noexcept;
+
+    // 构造函数：指定大小并填充值
+    compact_vector(size_t count, const T &value,
+                   const Allocator &alloc = Allocator());
+
+    // 构造函数：指定大小，默认构造元素
+    explicit compact_vector(size_t count, const Allocator &alloc = Allocator());
+
+    // 构造函数：从迭代器范围构造
+    template <std::input_iterator InputIt>
+    compact_vector(InputIt first, InputIt last,
+                   const Allocator &alloc = Allocator());
+
+    // 构造函数：初始化列表
+    compact_vector(std::initializer_list<T> ilist,
+                   const Allocator &alloc = Allocator());
+
+    // 拷贝构造函数（深拷贝，容量收紧到 size）
+    compact_vector(const compact_vector &other);
+
+    // 移动构造函数（只转移一个指针）
+    compact_vector(compact_vector &&other) noexcept;
+
+    // 析构函数：销毁元素并释放堆块
+    ~compact_vector();
+
+    // 拷贝赋值
+    compact_vector &operator=(const compact_vector &other);
+
+    // 移动赋值
+    compact_vector &operator=(compact_vector &&other) noexcept;
+
+    // 添加元素：拷贝版本
+    void push_back(const T &value);
+
+    // 添加元素：移动版本
+    void push_back(T &&value);
+
+    // 就地构造元素
+    template <typename... Args> void emplace_back(Args &&...args);
+
+    // 删除最后一个元素
+    void pop_back();
+
+    // 清空容器，保留堆块
+    void clear() noexcept;
+
+    // 保证至少有 new_cap 个元素的空间
+    void reserve(size_t new_cap);
+
+    // 重新设置容器大小
+    void resize(size_t new_size);
+
+    // resize：使用填充值
+    void resize(size_t new_size, const T &value);
+
+    // shrink_to_fit：释放多余内存，size 为 0 时释放整个堆块
+    void shrink_to_fit();
+
+    // 下标访问（不检查越界）
+    T &operator[](size_t index) noexcept { return data()[index]; }
+    const T &operator[](size_t index) const noexcept { return data()[index]; }
+
+    // 安全访问：带边界检查
+    T &at(size_t index);
+    const T &at(size_t index) const;
+
+    // 元素个数与容量（空容器没有堆块，均为 0）
+    size_t size() const noexcept { return block_ ? block_->size : 0; }
+    size_t capacity() const noexcept { return block_ ? block_->capacity : 0; }
+    bool empty() const noexcept { return size() == 0; }
+
+    // 最大元素个数：受 SizeType 与堆块字节数（不超过 PTRDIFF_MAX）共同限制
+    static constexpr size_t max_size() noexcept {
+        constexpr size_t by_size = std::numeric_limits<SizeType>::max();
+        constexpr size_t by_bytes = (PTRDIFF_MAX - __elem_offset) / sizeof(T);
+        return by_size < by_bytes ? by_size : by_bytes;
+    }
+
+    // 数据区指针
+    T *data() noexcept { return block_ ? __elements(block_) : nullptr; }
+    const T *data() const noexcept {
+        return block_ ? __elements(block_) : nullptr;
+    }
+
+    // 迭代器相关接口
+    iterator begin() noexcept { return iterator(data()); }
+    const_iterator begin() const noexcept { return const_iterator(data()); }
+    iterator end() noexcept { return iterator(data() + size()); }
+    const_iterator end() const noexcept {
+        return const_iterator(data() + size());
+    }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept {
+        return const_reverse_iterator(end());
+    }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept {
+        return const_reverse_iterator(begin());
+    }
+
+    // 返回第一个 / 最后一个元素
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+    reference back() { return *(end() - 1); }
+    const_reference back() const { return *(end() - 1); }
+
+  private:
+    // 堆块头部：紧跟在后面的是元素区
+    struct __header {
+        SizeType size;
+        SizeType capacity;
+    };
+
+    // 分配单位：对齐取头部与元素中较严格的一个
+    static constexpr size_t __unit_align =
+        alignof(T) > alignof(__header) ? alignof(T) : alignof(__header);
+    struct alignas(__unit_align) __unit {
+        unsigned char raw[__unit_align];
+    };
+
+    // 元素区相对块首的偏移（按 alignof(T) 向上取整）
+    static constexpr size_t __elem_offset =
+        (sizeof(__header) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    using __unit_alloc =
+        typename std::allocator_traits<Allocator>::template rebind_alloc<
+            __unit>;
+    using __unit_traits = std::allocator_traits<__unit_alloc>;
+
+    __header *block_;                        // 堆块指针（空容器为 nullptr）
+    [[no_unique_address]] __unit_alloc alloc_; // 分配器
+
+    static T *__elements(__header *h) noexcept {
+        return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(h) +
+                                     __elem_offset);
+    }
+    static const T *__elements(const __header *h) noexcept {
+        return reinterpret_cast<const T *>(
+            reinterpret_cast<const unsigned char *>(h) + __elem_offset);
+    }
+
+    static size_t __units_for(size_t cap) noexcept {
+        return (__elem_offset + cap * sizeof(T) + __unit_align - 1) /
+               __unit_align;
+    }
+
+    // 分配容量为 cap 的堆块，size 置 0
+    __header *__allocate_block(size_t cap);
+
+    // 释放堆块（不析构元素）
+    void __deallocate_block(__header *h) noexcept;
+
+    // 检查 n 是否超出 max_size()
+    static void __check_length(size_t n);
+
+    // 把元素搬到容量为 new_cap 的新堆块
+    void __reallocate(size_t new_cap);
+
+    // 扩容后的容量：翻倍策略，受 max_size() 限制
+    size_t __grow_capacity() const;
+
+    // 容量已满时的 emplace_back：先在新堆块中构造新元素，再搬迁旧元素，
+    // 最后释放旧堆块，因此 args 引用容器内元素（如 v.push_back(v[0])）也安全
+    template <typename... Args> void __emplace_back_grow(Args &&...args);
+};
+
+// 默认构造函数
+template <typename T, typename SizeType, typename Allocator>
+compact_vector<T, SizeType, Allocator>::compact_vector() noexcept
+    : block_(nullptr), alloc_() {}
+
+// 构造函数：指定大小并填充值
+template <typename T, typename SizeType, typename Allocator>
+compact_vector<T, SizeType, Allocator>::compact_vector(size_t count,
+                                                       const T &value,
+                                                       const Allocator &alloc)
+    : block_(nullptr), alloc_(alloc) {
+    try {
+        resize(count, value);
+    } catch (...) {
+        clear();
+        __deallocate_block(block_);
+        throw;
+    }
+}
+
+// 构造函数：默认值构造 count 个元素
+template <typename T, typename SizeType, typename Allocator>
+compact_vector<T, SizeType, Allocator>::compact_vector(size_t count,
+                                                       const Allocator &alloc)
+    : block_(nullptr), alloc_(alloc) {
+    try {
+        resize(count);
+    } catch (...) {
+        clear();
+        __deallocate_block(block_);
+        throw;
+    }
+}
+
+// 构造函数：从迭代器范围构造
+template <typename T, typename SizeType, typename Allocator>
+template <std::input_iterator InputIt>
+compact_vector<T, SizeType, Allocator>::compact_vector(InputIt first,
+                                                       InputIt last,
+                                                       const Allocator &alloc)
+    : block_(nullptr), alloc_(alloc) {
+    try {
+        reserve(std::distance(first, last));
+        for (; first != last; ++first)
+            emplace_back(*first);
+    } catch (...) {
+        clear();
+        __deallocate_block(block_);
+        throw;
+    }
+}
+
+// 构造函数：初始化列表
+template <typename T, typename SizeType, typename Allocator>
+compact_vector<T, SizeType, Allocator>::compact_vector(
+    std::initializer_list<T> ilist, const Allocator &alloc)
+    : compact_vector(ilist.begin(), ilist.end(), alloc) {}
+
+// 拷贝构造函数
+template <typename T, typename SizeType, typename Allocator>
+compact_vector<T, SizeType, Allocator>::compact_vector(
+    const compact_vector &other)
+    : block_(nullptr),
+      alloc_(__unit_traits::select_on_container_copy_construction(
+          other.alloc_)) {
+    try {
+        reserve(other.size());
+        for (const T &item : other)
+            push_back(item);
+    } catch (...) {
+        clear();
+        __deallocate_block(block_);
+        throw;
+    }
+}
+
+// 移动构造函数
+template <typename T, typename SizeType, typename Allocator>
+compact_vector<T, SizeType, Allocator>::compact_vector(
+    compact_vector &&other) noexcept
+    : block_(other.block_), alloc_(std::move(other.alloc_)) {
+    other.block_ = nullptr;
+}
+
+// 析构函数
+template <typename T, typename SizeType, typename Allocator>
+compact_vector<T, SizeType, Allocator>::~compact_vector() {
+    clear();
+    __deallocate_block(block_);
+}
+
+// 拷贝赋值
+template <typename T, typename SizeType, typename Allocator>
+compact_vector<T, SizeType, Allocator> &
+compact_vector<T, SizeType, Allocator>::operator=(const compact_vector &other) {
+    if (this != &other) {
+        compact_vector tmp(other);
+        *this = std::move(tmp);
+    }
+    return *this;
+}
+
+// 移动赋值
+template <typename T, typename SizeType, typename Allocator>
+compact_vector<T, SizeType, Allocator> &
+compact_vector<T, SizeType, Allocator>::operator=(
+    compact_vector &&other) noexcept {
+    if (this != &other) {
+        clear();
+        __deallocate_block(block_);
+        block_ = other.block_;
+        alloc_ = std::move(other.alloc_);
+        other.block_ = nullptr;
+    }
+    return *this;
+}
+
+// 分配堆块
+template <typename T, typename SizeType, typename Allocator>
+typename compact_vector<T, SizeType, Allocator>::__header *
+compact_vector<T, SizeType, Allocator>::__allocate_block(size_t cap) {
+    __unit *raw = __unit_traits::allocate(alloc_, __units_for(cap));
+    __header *h = std::construct_at(reinterpret_cast<__header *>(raw));
+    h->size = 0;
+    h->capacity = static_cast<SizeType>(cap);
+    return h;
+}
+
+// 释放堆块
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::__deallocate_block(
+    __header *h) noexcept {
+    if (!h)
+        return;
+    size_t units = __units_for(h->capacity);
+    std::destroy_at(h);
+    __unit_traits::deallocate(alloc_, reinterpret_cast<__unit *>(h), units);
+}
+
+// 长度检查
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::__check_length(size_t n) {
+    if (n > max_size())
+        throw std::length_error("compact_vector: size exceeds max_size()");
+}
+
+// 搬迁到新堆块
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::__reallocate(size_t new_cap) {
+    __header *new_block = __allocate_block(new_cap);
+    T *dst = __elements(new_block);
+    T *src = data();
+    size_t n = size();
+    size_t i = 0;
+    try {
+        for (; i < n; ++i)
+            std::construct_at(dst + i, std::move_if_noexcept(src[i]));
+    } catch (...) {
+        for (size_t j = 0; j < i; ++j)
+            std::destroy_at(dst + j);
+        __deallocate_block(new_block);
+        throw;
+    }
+
+    for (size_t j = 0; j < n; ++j)
+        std::destroy_at(src + j);
+    __deallocate_block(block_);
+
+    new_block->size = static_cast<SizeType>(n);
+    block_ = new_block;
+}
+
+// reserve 实现
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::reserve(size_t new_cap) {
+    if (new_cap <= capacity())
+        return;
+    __check_length(new_cap);
+    __reallocate(new_cap);
+}
+
+// 扩容容量：默认 2 倍扩容，不超过 max_size()
+template <typename T, typename SizeType, typename Allocator>
+size_t compact_vector<T, SizeType, Allocator>::__grow_capacity() const {
+    size_t cap = capacity();
+    if (cap == max_size())
+        throw std::length_error("compact_vector: size exceeds max_size()");
+    size_t new_cap = cap == 0 ? 1 : cap * 2;
+    return new_cap > max_size() ? max_size() : new_cap;
+}
+
+// 满容量追加
+template <typename T, typename SizeType, typename Allocator>
+template <typename... Args>
+void compact_vector<T, SizeType, Allocator>::__emplace_back_grow(
+    Args &&...args) {
+    size_t n = size();
+    __header *new_block = __allocate_block(__grow_capacity());
+    T *dst = __elements(new_block);
+    try {
+        std::construct_at(dst + n, std::forward<Args>(args)...);
+    } catch (...) {
+        __deallocate_block(new_block);
+        throw;
+    }
+
+    T *src = data();
+    size_t i = 0;
+    try {
+        for (; i < n; ++i)
+            std::construct_at(dst + i, std::move_if_noexcept(src[i]));
+    } catch (...) {
+        for (size_t j = 0; j < i; ++j)
+            std::destroy_at(dst + j);
+        std::destroy_at(dst + n);
+        __deallocate_block(new_block);
+        throw;
+    }
+
+    for (size_t j = 0; j < n; ++j)
+        std::destroy_at(src + j);
+    __deallocate_block(block_);
+
+    new_block->size = static_cast<SizeType>(n + 1);
+    block_ = new_block;
+}
+
+// push_back 实现
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::push_back(const T &value) {
+    emplace_back(value);
+}
+
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::push_back(T &&value) {
+    emplace_back(std::move(value));
+}
+
+// emplace_back 实现
+template <typename T, typename SizeType, typename Allocator>
+template <typename... Args>
+void compact_vector<T, SizeType, Allocator>::emplace_back(Args &&...args) {
+    if (size() == capacity()) {
+        __emplace_back_grow(std::forward<Args>(args)...);
+        return;
+    }
+    std::construct_at(data() + block_->size, std::forward<Args>(args)...);
+    ++block_->size;
+}
+
+// pop_back 实现
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::pop_back() {
+    --block_->size;
+    std::destroy_at(data() + block_->size);
+}
+
+// 清空容器
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::clear() noexcept {
+    if (!block_)
+        return;
+    T *p = data();
+    for (size_t i = 0; i < block_->size; ++i)
+        std::destroy_at(p + i);
+    block_->size = 0;
+}
+
+// 边界检查访问
+template <typename T, typename SizeType, typename Allocator>
+T &compact_vector<T, SizeType, Allocator>::at(size_t index) {
+    if (index >= size())
+        throw std::out_of_range("compact_vector::at: index out of range");
+    return data()[index];
+}
+
+template <typename T, typename SizeType, typename Allocator>
+const T &compact_vector<T, SizeType, Allocator>::at(size_t index) const {
+    if (index >= size())
+        throw std::out_of_range("compact_vector::at: index out of range");
+    return data()[index];
+}
+
+// resize 实现：缩小销毁，扩大默认构造
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::resize(size_t new_size) {
+    while (size() > new_size)
+        pop_back();
+    if (new_size > size()) {
+        reserve(new_size);
+        while (size() < new_size)
+            emplace_back();
+    }
+}
+
+// resize 实现：使用填充值
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::resize(size_t new_size,
+                                                    const T &value) {
+    while (size() > new_size)
+        pop_back();
+    if (new_size <= size())
+        return;
+    if (new_size <= capacity()) {
+        while (size() < new_size)
+            push_back(value);
+        return;
+    }
+    // value 可能引用容器内元素，reserve 会释放旧堆块，先拷贝一份
+    T fill(value);
+    reserve(new_size);
+    while (size() < new_size)
+        push_back(fill);
+}
+
+// shrink_to_fit 实现
+template <typename T, typename SizeType, typename Allocator>
+void compact_vector<T, SizeType, Allocator>::shrink_to_fit() {
+    if (size() == capacity())
+        return;
+    if (size() == 0) {
+        __deallocate_block(block_);
+        block_ = nullptr;
+        return;
+    }
+    __reallocate(size());
+}
+
+} // namespace mini_stl
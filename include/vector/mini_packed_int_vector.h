@@ -0,0 +1,486 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include "mini_vector.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace mini_stl {
+
+// packed_int_vector：按 128 个值分块位压缩的 uint64_t 序列
+// 每块自动选择编码与位宽：
+//   - 基准偏移（FOR）：存 value - min，位宽为 bit_width(max - min)
+//   - 差分（delta）：块内非递减且跨度小于 2^32 时存相邻差值，
+//     连同检查点在内占用更少字时选用
+// 追加的值先放在未压缩的尾块中，满 128 个后压缩。
+//
+// 存储以 32 位字为单位，一块 128 个 w 位的值恰好占 4w 个字：
+//   - w <= 32：4 路纵向交错（第 j 个值属于第 j % 4 路的第 j / 4 个），
+//     四路的移位模式相同，一条 128 位 SIMD 指令同时解 4 个值
+//   - w > 32（只有 FOR 块）：按 64 位字横向顺序存放
+// delta 块在数据前另存 8 个 32 位检查点（每 16 个值一个），
+// 随机访问最多累加 15 个差值。
+class packed_int_vector {
+  public:
+    using value_type = std::uint64_t;
+
+    static constexpr size_t block_size = 128;
+
+    // 默认构造函数
+    packed_int_vector() = default;
+
+    // 构造函数：从迭代器范围构造
+    template <std::input_iterator InputIt>
+    packed_int_vector(InputIt first, InputIt last);
+
+    // 构造函数：初始化列表
+    packed_int_vector(std::initializer_list<std::uint64_t> ilist);
+
+    // 追加一个值，尾块满时自动压缩
+    void push_back(std::uint64_t value);
+
+    // 随机访问：FOR 块解一个值，delta 块从最近的检查点最多累加 15 个差值
+    std::uint64_t operator[](size_t index) const;
+
+    // 安全访问：带边界检查
+    std::uint64_t at(size_t index) const;
+
+    // 获取当前元素数量
+    size_t size() const noexcept {
+        return blocks_.size() * block_size + tail_.size();
+    }
+    bool empty() const noexcept { return size() == 0; }
+
+    // 块个数（包含未满的尾块）
+    size_t block_count() const noexcept {
+        return (size() + block_size - 1) / block_size;
+    }
+
+    // 解码第 block 块到 out（至少 block_size 个空间），返回该块的值个数
+    size_t decode_block(size_t block, std::uint64_t *out) const;
+
+    // 整体解码到 mini_stl::vector（覆盖原内容）
+    void decode(mini_stl::vector<std::uint64_t> &out) const;
+
+    // 按块回调：f(const uint64_t *values, size_t count)
+    template <typename F> void for_each_block(F &&f) const;
+
+    // 逐值回调：f(uint64_t value)
+    template <typename F> void for_each(F &&f) const;
+
+    // 清空容器
+    void clear() noexcept;
+
+    // 压缩后占用的字节数（不含对象本身）
+    size_t memory_bytes() const noexcept;
+
+  private:
+    // 块描述
+    struct __block {
+        std::uint64_t base;   // FOR：块内最小值；delta：块内第一个值
+        std::uint32_t offset; // 在 words_ 中的起始字
+        std::uint8_t width;   // 位宽 0 ~ 64
+        bool delta;           // 是否为差分编码
+    };
+
+    static constexpr size_t __lanes = 4;        // 纵向交错的路数
+    static constexpr size_t __ckpt_stride = 16; // 检查点间隔
+    static constexpr size_t __ckpt_words = block_size / __ckpt_stride;
+
+    mini_stl::vector<std::uint32_t> words_; // 检查点与位压缩数据
+    mini_stl::vector<__block> blocks_;      // 已压缩的块
+    mini_stl::vector<std::uint64_t> tail_;  // 未压缩的尾块
+
+    static constexpr std::uint32_t __mask32(unsigned width) noexcept {
+        return width >= 32 ? ~std::uint32_t(0)
+                           : (std::uint32_t(1) << width) - 1;
+    }
+    static constexpr std::uint64_t __mask64(unsigned width) noexcept {
+        return width >= 64 ? ~std::uint64_t(0)
+                           : (std::uint64_t(1) << width) - 1;
+    }
+
+    // 从 32 位字存储中读取第 word 个 64 位字
+    static std::uint64_t __load64(const std::uint32_t *in,
+                                  size_t word) noexcept {
+        std::uint64_t v;
+        std::memcpy(&v, in + 2 * word, sizeof(v));
+        return v;
+    }
+
+    // 纵向布局：第 I 组（值 4I ~ 4I+3）中第 lane 路的 W 位值
+    // 字下标与移位量都是编译期常量，没有分支
+    template <unsigned W, size_t I>
+    static std::uint32_t __get_lane(const std::uint32_t *in,
+                                    size_t lane) noexcept;
+
+    // 横向布局（W > 32）：第 J 个 W 位的值
+    template <unsigned W, size_t J>
+    static std::uint64_t __get_wide(const std::uint32_t *in) noexcept;
+
+    // 按位宽特化的解码：加 base / 前缀和与解包在同一趟完成
+    template <unsigned W, bool Delta, size_t... I>
+    static void __decode_narrow(const std::uint32_t *in, std::uint64_t base,
+                                std::uint64_t *out, std::index_sequence<I...>);
+
+    template <unsigned W, size_t... J>
+    static void __decode_wide(const std::uint32_t *in, std::uint64_t base,
+                              std::uint64_t *out, std::index_sequence<J...>);
+
+    // 把运行期位宽与编码分派到对应的特化版本
+    static void __decode_dispatch(const __block &blk, const std::uint32_t *in,
+                                  std::uint64_t *out);
+
+    // 读取块内第 j 个原始（未加 base）值
+    static std::uint64_t __extract(const std::uint32_t *in, unsigned width,
+                                   size_t j) noexcept;
+
+    // 块的位压缩数据起点（delta 块跳过检查点）
+    const std::uint32_t *__packed(const __block &blk) const noexcept {
+        return &words_[0] + blk.offset + (blk.delta ? __ckpt_words : 0);
+    }
+
+    // 压缩尾块
+    void __flush_tail();
+};
+
+template <std::input_iterator InputIt>
+packed_int_vector::packed_int_vector(InputIt first, InputIt last) {
+    for (; first != last; ++first)
+        push_back(*first);
+}
+
+inline packed_int_vector::packed_int_vector(
+    std::initializer_list<std::uint64_t> ilist)
+    : packed_int_vector(ilist.begin(), ilist.end()) {}
+
+template <unsigned W, size_t I>
+std::uint32_t packed_int_vector::__get_lane(const std::uint32_t *in,
+                                            size_t lane) noexcept {
+    constexpr size_t bit = I * W;
+    constexpr size_t word = bit >> 5;
+    constexpr unsigned shift = bit & 31;
+    std::uint32_t v = in[word * __lanes + lane] >> shift;
+    if constexpr (shift + W > 32)
+        v |= in[(word + 1) * __lanes + lane] << (32 - shift);
+    return v & __mask32(W);
+}
+
+template <unsigned W, size_t J>
+std::uint64_t packed_int_vector::__get_wide(const std::uint32_t *in) noexcept {
+    constexpr size_t bit = J * W;
+    constexpr size_t word = bit >> 6;
+    constexpr unsigned shift = bit & 63;
+    std::uint64_t v = __load64(in, word) >> shift;
+    if constexpr (shift + W > 64)
+        v |= __load64(in, word + 1) << (64 - shift);
+    return v & __mask64(W);
+}
+
+template <unsigned W, bool Delta, size_t... I>
+void packed_int_vector::__decode_narrow(const std::uint32_t *in,
+                                        std::uint64_t base,
+                                        std::uint64_t *out,
+                                        std::index_sequence<I...>) {
+#if defined(__SSE2__)
+    // 每组 4 个 32 位值：SSE 解包，组内前缀和加上一组的进位，
+    // 再扩展为 4 个 64 位并加 base（有 AVX2 时一条指令完成）
+#if defined(__AVX2__)
+    const __m256i vbase = _mm256_set1_epi64x(static_cast<long long>(base));
+#else
+    const __m128i vbase = _mm_set1_epi64x(static_cast<long long>(base));
+    const __m128i zero = _mm_setzero_si128();
+#endif
+    const __m128i vmask = _mm_set1_epi32(static_cast<int>(__mask32(W)));
+    __m128i carry = _mm_setzero_si128();
+    auto group = [&]<size_t G>(std::integral_constant<size_t, G>) {
+        constexpr size_t bit = G * W;
+        constexpr size_t word = bit >> 5;
+        constexpr int shift = bit & 31;
+        __m128i x = _mm_srli_epi32(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(in + word * __lanes)),
+            shift);
+        if constexpr (shift + W > 32)
+            x = _mm_or_si128(
+                x, _mm_slli_epi32(
+                       _mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                           in + (word + 1) * __lanes)),
+                       32 - shift));
+        if constexpr (W < 32)
+            x = _mm_and_si128(x, vmask);
+        if constexpr (Delta) {
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+            x = _mm_add_epi32(x, carry);
+            carry = _mm_shuffle_epi32(x, 0xFF);
+        }
+#if defined(__AVX2__)
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i *>(out + G * __lanes),
+            _mm256_add_epi64(_mm256_cvtepu32_epi64(x), vbase));
+#else
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i *>(out + G * __lanes),
+            _mm_add_epi64(_mm_unpacklo_epi32(x, zero), vbase));
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i *>(out + G * __lanes + 2),
+            _mm_add_epi64(_mm_unpackhi_epi32(x, zero), vbase));
+#endif
+    };
+    (group(std::integral_constant<size_t, I>{}), ...);
+    (void)vmask;
+    (void)carry;
+#else
+    // 可移植版本：四路写成相同的语句，便于编译器做 SLP 向量化
+    std::uint32_t acc = 0;
+    auto group = [&]<size_t G>(std::integral_constant<size_t, G>) {
+        for (size_t lane = 0; lane < __lanes; ++lane) {
+            std::uint32_t v = __get_lane<W, G>(in, lane);
+            if constexpr (Delta)
+                v = acc += v;
+            out[G * __lanes + lane] = base + v;
+        }
+    };
+    (group(std::integral_constant<size_t, I>{}), ...);
+    (void)acc;
+#endif
+}
+
+template <unsigned W, size_t... J>
+void packed_int_vector::__decode_wide(const std::uint32_t *in,
+                                      std::uint64_t base, std::uint64_t *out,
+                                      std::index_sequence<J...>) {
+    ((out[J] = base + __get_wide<W, J>(in)), ...);
+}
+
+// 分派由折叠表达式展开，编译器生成跳转表，直接调用各特化版本
+inline void packed_int_vector::__decode_dispatch(const __block &blk,
+                                                 const std::uint32_t *in,
+                                                 std::uint64_t *out) {
+    if (blk.width == 0) {
+        for (size_t j = 0; j < block_size; ++j)
+            out[j] = blk.base;
+        return;
+    }
+    constexpr auto groups = std::make_index_sequence<block_size / __lanes>{};
+    [&]<unsigned... W>(std::integer_sequence<unsigned, W...>) {
+        (void)((blk.width == W + 1
+                    ? (blk.delta
+                           ? __decode_narrow<W + 1, true>(in, blk.base, out,
+                                                          groups)
+                           : __decode_narrow<W + 1, false>(in, blk.base, out,
+                                                           groups),
+                       true)
+                    : false) ||
+               ...);
+    }(std::make_integer_sequence<unsigned, 32>{});
+    [&]<unsigned... W>(std::integer_sequence<unsigned, W...>) {
+        (void)((blk.width == W + 33
+                    ? (__decode_wide<W + 33>(
+                           in, blk.base, out,
+                           std::make_index_sequence<block_size>{}),
+                       true)
+                    : false) ||
+               ...);
+    }(std::make_integer_sequence<unsigned, 32>{});
+}
+
+inline std::uint64_t packed_int_vector::__extract(const std::uint32_t *in,
+                                                  unsigned width,
+                                                  size_t j) noexcept {
+    if (width == 0)
+        return 0;
+    if (width > 32) {
+        size_t bit = j * width;
+        size_t word = bit >> 6;
+        unsigned shift = bit & 63;
+        std::uint64_t v = __load64(in, word) >> shift;
+        if (shift + width > 64)
+            v |= __load64(in, word + 1) << (64 - shift);
+        return v & __mask64(width);
+    }
+    size_t lane = j % __lanes;
+    size_t bit = (j / __lanes) * width;
+    size_t word = bit >> 5;
+    unsigned shift = bit & 31;
+    std::uint32_t v = in[word * __lanes + lane] >> shift;
+    if (shift + width > 32)
+        v |= in[(word + 1) * __lanes + lane] << (32 - shift);
+    return v & __mask32(width);
+}
+
+// 压缩尾块：比较 FOR 与 delta（含检查点）的字数，取较小者
+inline void packed_int_vector::__flush_tail() {
+    std::uint64_t lo = tail_[0], hi = tail_[0];
+    std::uint64_t max_delta = 0;
+    bool sorted = true;
+    for (size_t j = 1; j < block_size; ++j) {
+        std::uint64_t v = tail_[j];
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+        if (v < tail_[j - 1])
+            sorted = false;
+        else if (v - tail_[j - 1] > max_delta)
+            max_delta = v - tail_[j - 1];
+    }
+
+    unsigned for_width = std::bit_width(hi - lo);
+    unsigned delta_width = std::bit_width(max_delta);
+
+    // 块内前缀和与检查点都是相对 base 的 32 位值，跨度过大时不用 delta；
+    // 字数相同时选 FOR，随机访问不必累加差值
+    __block blk;
+    blk.delta = sorted && hi - lo <= UINT32_MAX &&
+                __ckpt_words + 4 * delta_width < 4 * for_width;
+    blk.width = static_cast<std::uint8_t>(blk.delta ? delta_width : for_width);
+    blk.base = blk.delta ? tail_[0] : lo;
+    if (words_.size() > UINT32_MAX)
+        throw std::length_error("packed_int_vector: too many words");
+    blk.offset = static_cast<std::uint32_t>(words_.size());
+
+    // resize 只按需 reserve，这里手动翻倍避免每块都重新分配
+    size_t n_ckpt = blk.delta ? __ckpt_words : 0;
+    size_t n_words = n_ckpt + 4 * blk.width; // 128 * width / 32
+    size_t need = words_.size() + n_words;
+    if (need > words_.capacity())
+        words_.reserve(need > 2 * words_.capacity() ? need
+                                                    : 2 * words_.capacity());
+    words_.resize(need, 0);
+    if (n_words == 0) {
+        blocks_.push_back(blk);
+        tail_.clear();
+        return;
+    }
+
+    std::uint32_t *ckpt = &words_[0] + blk.offset;
+    for (size_t k = 0; k < n_ckpt; ++k)
+        ckpt[k] =
+            static_cast<std::uint32_t>(tail_[k * __ckpt_stride] - blk.base);
+
+    std::uint32_t *out = ckpt + n_ckpt;
+    unsigned w = blk.width;
+    for (size_t j = 0; j < block_size; ++j) {
+        std::uint64_t v = blk.delta ? (j == 0 ? 0 : tail_[j] - tail_[j - 1])
+                                    : tail_[j] - lo;
+        if (w <= 32) {
+            size_t lane = j % __lanes;
+            size_t bit = (j / __lanes) * w;
+            size_t word = bit >> 5;
+            unsigned shift = bit & 31;
+            out[word * __lanes + lane] |= static_cast<std::uint32_t>(v << shift);
+            if (shift + w > 32)
+                out[(word + 1) * __lanes + lane] |=
+                    static_cast<std::uint32_t>(v >> (32 - shift));
+        } else {
+            size_t bit = j * w;
+            size_t word = bit >> 6;
+            unsigned shift = bit & 63;
+            std::uint64_t cur = __load64(out, word) | (v << shift);
+            std::memcpy(out + 2 * word, &cur, sizeof(cur));
+            if (shift + w > 64) {
+                std::uint64_t next =
+                    __load64(out, word + 1) | (v >> (64 - shift));
+                std::memcpy(out + 2 * (word + 1), &next, sizeof(next));
+            }
+        }
+    }
+
+    blocks_.push_back(blk);
+    tail_.clear();
+}
+
+inline void packed_int_vector::push_back(std::uint64_t value) {
+    if (tail_.capacity() == 0)
+        tail_.reserve(block_size);
+    tail_.push_back(value);
+    if (tail_.size() == block_size)
+        __flush_tail();
+}
+
+inline std::uint64_t packed_int_vector::operator[](size_t index) const {
+    size_t b = index / block_size;
+    size_t j = index % block_size;
+    if (b == blocks_.size())
+        return tail_[j];
+
+    const __block &blk = blocks_[b];
+    if (blk.width == 0)
+        return blk.base;
+    const std::uint32_t *in = __packed(blk);
+    if (!blk.delta)
+        return blk.base + __extract(in, blk.width, j);
+
+    // 从检查点 k 开始累加 (16k, j] 的差值，块内相对值不超过 32 位
+    size_t k = j / __ckpt_stride;
+    std::uint32_t rel = words_[blk.offset + k];
+    for (size_t t = k * __ckpt_stride + 1; t <= j; ++t)
+        rel += static_cast<std::uint32_t>(__extract(in, blk.width, t));
+    return blk.base + rel;
+}
+
+inline std::uint64_t packed_int_vector::at(size_t index) const {
+    if (index >= size())
+        throw std::out_of_range("packed_int_vector::at: index out of range");
+    return (*this)[index];
+}
+
+inline size_t packed_int_vector::decode_block(size_t block,
+                                              std::uint64_t *out) const {
+    if (block == blocks_.size()) {
+        for (size_t j = 0; j < tail_.size(); ++j)
+            out[j] = tail_[j];
+        return tail_.size();
+    }
+
+    const __block &blk = blocks_[block];
+    __decode_dispatch(blk, blk.width ? __packed(blk) : nullptr, out);
+    return block_size;
+}
+
+inline void packed_int_vector::decode(
+    mini_stl::vector<std::uint64_t> &out) const {
+    out.resize(size());
+    for (size_t b = 0; b < block_count(); ++b)
+        decode_block(b, &out[0] + b * block_size);
+}
+
+template <typename F> void packed_int_vector::for_each_block(F &&f) const {
+    alignas(64) std::uint64_t buf[block_size];
+    for (size_t b = 0; b < block_count(); ++b) {
+        size_t n = decode_block(b, buf);
+        f(static_cast<const std::uint64_t *>(buf), n);
+    }
+}
+
+template <typename F> void packed_int_vector::for_each(F &&f) const {
+    for_each_block([&f](const std::uint64_t *values, size_t n) {
+        for (size_t j = 0; j < n; ++j)
+            f(values[j]);
+    });
+}
+
+inline void packed_int_vector::clear() noexcept {
+    words_.clear();
+    blocks_.clear();
+    tail_.clear();
+}
+
+inline size_t packed_int_vector::memory_bytes() const noexcept {
+    return words_.capacity() * sizeof(std::uint32_t) +
+           blocks_.capacity() * sizeof(__block) +
+           tail_.capacity() * sizeof(std::uint64_t);
+}
+
+} // namespace mini_stl
@@ -0,0 +1,456 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "mini_vector.h"
+
+namespace mini_stl {
+
+template <typename T> class transient_vector;
+
+// persistent_vector：32 路前缀树 + 尾块的持久化向量
+// 拷贝只复制根和尾块两个 shared_ptr，是 O(1) 的快照；
+// push_back / set 只复制被修改路径上的节点（路径拷贝），
+// 其余节点在各个版本之间共享。批量修改请使用 transient_vector。
+template <typename T> class persistent_vector {
+  public:
+    using value_type = T;
+    using reference = const T &;
+    using const_reference = const T &;
+
+    class const_iterator;
+
+    // 默认构造函数：共享空节点，不分配内存
+    persistent_vector();
+
+    // 构造函数：从迭代器范围构造（内部使用 transient 批量写入）
+    template <std::input_iterator InputIt>
+    persistent_vector(InputIt first, InputIt last);
+
+    // 构造函数：初始化列表
+    persistent_vector(std::initializer_list<T> ilist);
+
+    // 拷贝构造 / 拷贝赋值：O(1) 快照，不复制元素
+    persistent_vector(const persistent_vector &other) = default;
+    persistent_vector &operator=(const persistent_vector &other) = default;
+
+    // 添加元素：只复制尾块（尾块满时复制一条根到叶的路径）
+    void push_back(const T &value);
+    void push_back(T &&value);
+
+    // 修改元素：只复制根到该元素所在叶子的路径
+    void set(size_t index, const T &value);
+    void set(size_t index, T &&value);
+
+    // 下标访问（不检查越界），O(log32 n)
+    const T &operator[](size_t index) const;
+
+    // 安全访问：带边界检查
+    const T &at(size_t index) const;
+
+    // 获取当前元素数量
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    // 返回第一个 / 最后一个元素
+    const_reference front() const { return (*this)[0]; }
+    const_reference back() const { return (*this)[size_ - 1]; }
+
+    // 迭代器：按 32 元素的块缓存叶子，顺序遍历均摊 O(1)
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, size_); }
+
+    // 以当前内容创建一个可原地批量修改的 transient_vector
+    transient_vector<T> transient() const;
+
+    class const_iterator {
+      public:
+        using value_type = T;
+        using pointer = const T *;
+        using reference = const T &;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        const_iterator() : vec_(nullptr), index_(0), chunk_(nullptr) {}
+
+        reference operator*() const { return chunk_[index_ & __mask]; }
+        pointer operator->() const { return chunk_ + (index_ & __mask); }
+
+        const_iterator &operator++() {
+            ++index_;
+            if ((index_ & __mask) == 0 && index_ < vec_->size_)
+                chunk_ = vec_->__chunk_for(index_);
+            return *this;
+        }
+        const_iterator operator++(int) {
+            const_iterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const const_iterator &rhs) const {
+            return index_ == rhs.index_;
+        }
+        bool operator!=(const const_iterator &rhs) const {
+            return index_ != rhs.index_;
+        }
+
+      private:
+        friend class persistent_vector;
+
+        const_iterator(const persistent_vector *vec, size_t index)
+            : vec_(vec), index_(index),
+              chunk_(index < vec->size_ ? vec->__chunk_for(index) : nullptr) {
+        }
+
+        const persistent_vector *vec_;
+        size_t index_;
+        const T *chunk_; // 当前叶子的元素区
+    };
+
+  private:
+    friend class transient_vector<T>;
+
+    static constexpr size_t __bits = 5;
+    static constexpr size_t __width = size_t(1) << __bits;
+    static constexpr size_t __mask = __width - 1;
+
+    // 节点：分支节点只用 children，叶子只用 values
+    // owner 为创建该节点的 transient 编号，0 表示已冻结（持久化）
+    struct __node {
+        std::uint64_t owner = 0;
+        mini_stl::vector<std::shared_ptr<__node>> children;
+        mini_stl::vector<T> values;
+    };
+    using __node_ptr = std::shared_ptr<__node>;
+
+    size_t size_;      // 元素个数
+    size_t shift_;     // 根节点的层级位移（最小为 __bits）
+    __node_ptr root_;  // 前缀树根
+    __node_ptr tail_;  // 尾块（最后不足 32 个元素）
+    std::uint64_t edit_ = 0; // 当前编辑编号，persistent_vector 恒为 0
+
+    // 全部空向量共享的空节点（owner 为 0，永远不会被原地修改）
+    static const __node_ptr &__empty_node();
+
+    // 分配新的 transient 编号
+    static std::uint64_t __next_edit();
+
+    // 尾块之前的元素个数
+    size_t __tail_offset() const noexcept {
+        return size_ < __width ? 0 : ((size_ - 1) >> __bits) << __bits;
+    }
+
+    // 返回 index 所在叶子的元素区
+    const T *__chunk_for(size_t index) const;
+
+    // 新建一个属于当前编辑的节点
+    __node_ptr __make_node(bool leaf) const;
+
+    // 若节点不属于当前编辑则复制一份，否则原地返回
+    __node_ptr __editable(const __node_ptr &node, bool leaf) const;
+
+    // 为 node 构建 level 层高的单链路径
+    __node_ptr __new_path(size_t level, __node_ptr node) const;
+
+    // 把满的尾块挂到树上
+    __node_ptr __push_tail(size_t level, const __node_ptr &parent,
+                           __node_ptr tail_node) const;
+
+    template <typename U>
+    __node_ptr __do_set(size_t level, const __node_ptr &node, size_t index,
+                        U &&value) const;
+
+    template <typename U> void __push_back(U &&value);
+    template <typename U> void __set(size_t index, U &&value);
+};
+
+// transient_vector：persistent_vector 的批量构建模式
+// 只有本 transient 创建（或已复制过）的节点会被原地修改，
+// 与其他快照共享的节点在第一次修改时复制一次。不可拷贝，可移动。
+template <typename T> class transient_vector {
+  public:
+    using value_type = T;
+
+    // 从空向量开始构建
+    transient_vector() : transient_vector(persistent_vector<T>()) {}
+
+    // 从某个快照开始构建（O(1)）
+    explicit transient_vector(const persistent_vector<T> &base);
+
+    transient_vector(const transient_vector &) = delete;
+    transient_vector &operator=(const transient_vector &) = delete;
+
+    // 移动：接管编辑编号与节点，源对象变为使用新编号的空 transient
+    // （不能默认生成：两个对象持有同一编号会原地修改彼此的节点）
+    transient_vector(transient_vector &&other) noexcept;
+    transient_vector &operator=(transient_vector &&other) noexcept;
+
+    // 原地添加 / 修改元素
+    void push_back(const T &value) { impl_.__push_back(value); }
+    void push_back(T &&value) { impl_.__push_back(std::move(value)); }
+    void set(size_t index, const T &value) { impl_.__set(index, value); }
+    void set(size_t index, T &&value) { impl_.__set(index, std::move(value)); }
+
+    const T &operator[](size_t index) const { return impl_[index]; }
+    const T &at(size_t index) const { return impl_.at(index); }
+    size_t size() const noexcept { return impl_.size(); }
+    bool empty() const noexcept { return impl_.empty(); }
+
+    // 冻结当前内容并返回快照（O(1)）
+    // 之后本 transient 换用新的编号，继续修改不会影响返回的快照
+    persistent_vector<T> persistent();
+
+  private:
+    persistent_vector<T> impl_;
+};
+
+// 空节点
+template <typename T>
+const typename persistent_vector<T>::__node_ptr &
+persistent_vector<T>::__empty_node() {
+    static const __node_ptr empty = std::make_shared<__node>();
+    return empty;
+}
+
+// transient 编号：从 1 开始递增
+template <typename T> std::uint64_t persistent_vector<T>::__next_edit() {
+    static std::atomic<std::uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+// 默认构造函数
+template <typename T>
+persistent_vector<T>::persistent_vector()
+    : size_(0), shift_(__bits), root_(__empty_node()), tail_(__empty_node()) {}
+
+// 构造函数：从迭代器范围构造
+template <typename T>
+template <std::input_iterator InputIt>
+persistent_vector<T>::persistent_vector(InputIt first, InputIt last)
+    : persistent_vector() {
+    transient_vector<T> builder(*this);
+    for (; first != last; ++first)
+        builder.push_back(*first);
+    *this = builder.persistent();
+}
+
+// 构造函数：初始化列表
+template <typename T>
+persistent_vector<T>::persistent_vector(std::initializer_list<T> ilist)
+    : persistent_vector(ilist.begin(), ilist.end()) {}
+
+// 元素访问
+template <typename T>
+const T *persistent_vector<T>::__chunk_for(size_t index) const {
+    const __node *node;
+    if (index >= __tail_offset()) {
+        node = tail_.get();
+    } else {
+        node = root_.get();
+        for (size_t level = shift_; level > 0; level -= __bits)
+            node = node->children[(index >> level) & __mask].get();
+    }
+    return &node->values[0];
+}
+
+template <typename T>
+const T &persistent_vector<T>::operator[](size_t index) const {
+    return __chunk_for(index)[index & __mask];
+}
+
+template <typename T> const T &persistent_vector<T>::at(size_t index) const {
+    if (index >= size_)
+        throw std::out_of_range("persistent_vector::at: index out of range");
+    return (*this)[index];
+}
+
+// 新建节点：预留满宽度，transient 原地追加时不再扩容
+template <typename T>
+typename persistent_vector<T>::__node_ptr
+persistent_vector<T>::__make_node(bool leaf) const {
+    __node_ptr node = std::make_shared<__node>();
+    node->owner = edit_;
+    if (leaf)
+        node->values.reserve(__width);
+    else
+        node->children.reserve(__width);
+    return node;
+}
+
+// 路径拷贝的核心：只有属于当前 transient 的节点可以原地修改
+template <typename T>
+typename persistent_vector<T>::__node_ptr
+persistent_vector<T>::__editable(const __node_ptr &node, bool leaf) const {
+    if (edit_ != 0 && node->owner == edit_)
+        return node;
+    __node_ptr copy = __make_node(leaf);
+    if (leaf) {
+        for (const T &item : node->values)
+            copy->values.push_back(item);
+    } else {
+        for (const __node_ptr &child : node->children)
+            copy->children.push_back(child);
+    }
+    return copy;
+}
+
+template <typename T>
+typename persistent_vector<T>::__node_ptr
+persistent_vector<T>::__new_path(size_t level, __node_ptr node) const {
+    if (level == 0)
+        return node;
+    __node_ptr ret = __make_node(false);
+    ret->children.push_back(__new_path(level - __bits, std::move(node)));
+    return ret;
+}
+
+template <typename T>
+typename persistent_vector<T>::__node_ptr
+persistent_vector<T>::__push_tail(size_t level, const __node_ptr &parent,
+                                  __node_ptr tail_node) const {
+    // 顺序追加：subidx 要么是最后一个孩子，要么是新孩子
+    size_t subidx = ((size_ - 1) >> level) & __mask;
+    __node_ptr ret = __editable(parent, false);
+    __node_ptr to_insert;
+    if (level == __bits) {
+        to_insert = std::move(tail_node);
+    } else if (subidx < ret->children.size()) {
+        to_insert = __push_tail(level - __bits, ret->children[subidx],
+                                std::move(tail_node));
+    } else {
+        to_insert = __new_path(level - __bits, std::move(tail_node));
+    }
+    if (subidx < ret->children.size())
+        ret->children[subidx] = std::move(to_insert);
+    else
+        ret->children.push_back(std::move(to_insert));
+    return ret;
+}
+
+template <typename T>
+template <typename U>
+void persistent_vector<T>::__push_back(U &&value) {
+    // 尾块未满：只复制 / 修改尾块
+    if (size_ - __tail_offset() < __width) {
+        __node_ptr tail = __editable(tail_, true);
+        tail->values.push_back(std::forward<U>(value));
+        tail_ = std::move(tail);
+        ++size_;
+        return;
+    }
+
+    // 尾块已满：先建好新尾块，再把旧尾块挂到树上
+    __node_ptr new_tail = __make_node(true);
+    new_tail->values.push_back(std::forward<U>(value));
+
+    __node_ptr new_root;
+    size_t new_shift = shift_;
+    if ((size_ >> __bits) > (size_t(1) << shift_)) {
+        // 根已满：增加一层
+        new_root = __make_node(false);
+        new_root->children.push_back(root_);
+        new_root->children.push_back(__new_path(shift_, tail_));
+        new_shift += __bits;
+    } else {
+        new_root = __push_tail(shift_, root_, tail_);
+    }
+
+    root_ = std::move(new_root);
+    tail_ = std::move(new_tail);
+    shift_ = new_shift;
+    ++size_;
+}
+
+template <typename T>
+template <typename U>
+typename persistent_vector<T>::__node_ptr
+persistent_vector<T>::__do_set(size_t level, const __node_ptr &node,
+                               size_t index, U &&value) const {
+    __node_ptr ret = __editable(node, level == 0);
+    if (level == 0) {
+        ret->values[index & __mask] = std::forward<U>(value);
+    } else {
+        size_t subidx = (index >> level) & __mask;
+        ret->children[subidx] = __do_set(level - __bits, ret->children[subidx],
+                                         index, std::forward<U>(value));
+    }
+    return ret;
+}
+
+template <typename T>
+template <typename U>
+void persistent_vector<T>::__set(size_t index, U &&value) {
+    if (index >= size_)
+        throw std::out_of_range("persistent_vector::set: index out of range");
+    if (index >= __tail_offset()) {
+        __node_ptr tail = __editable(tail_, true);
+        tail->values[index & __mask] = std::forward<U>(value);
+        tail_ = std::move(tail);
+    } else {
+        root_ = __do_set(shift_, root_, index, std::forward<U>(value));
+    }
+}
+
+// push_back / set 实现
+template <typename T> void persistent_vector<T>::push_back(const T &value) {
+    __push_back(value);
+}
+
+template <typename T> void persistent_vector<T>::push_back(T &&value) {
+    __push_back(std::move(value));
+}
+
+template <typename T>
+void persistent_vector<T>::set(size_t index, const T &value) {
+    __set(index, value);
+}
+
+template <typename T> void persistent_vector<T>::set(size_t index, T &&value) {
+    __set(index, std::move(value));
+}
+
+template <typename T>
+transient_vector<T> persistent_vector<T>::transient() const {
+    return transient_vector<T>(*this);
+}
+
+// transient_vector 实现
+template <typename T>
+transient_vector<T>::transient_vector(const persistent_vector<T> &base)
+    : impl_(base) {
+    impl_.edit_ = persistent_vector<T>::__next_edit();
+}
+
+template <typename T>
+transient_vector<T>::transient_vector(transient_vector &&other) noexcept
+    : impl_(other.impl_) {
+    other.impl_ = persistent_vector<T>();
+    other.impl_.edit_ = persistent_vector<T>::__next_edit();
+}
+
+template <typename T>
+transient_vector<T> &
+transient_vector<T>::operator=(transient_vector &&other) noexcept {
+    if (this != &other) {
+        impl_ = other.impl_;
+        other.impl_ = persistent_vector<T>();
+        other.impl_.edit_ = persistent_vector<T>::__next_edit();
+    }
+    return *this;
+}
+
+template <typename T> persistent_vector<T> transient_vector<T>::persistent() {
+    persistent_vector<T> result(impl_);
+    result.edit_ = 0;
+    impl_.edit_ = persistent_vector<T>::__next_edit();
+    return result;
+}
+
+} // namespace mini_stl
@@ -1,13 +1,28 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include "mini_iterator.h"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// 软件预取：rw 为 0 表示读，1 表示写
+#if defined(__GNUC__) || defined(__clang__)
+#define MINI_STL_PREFETCH(addr, rw) __builtin_prefetch((addr), (rw))
+#else
+#define MINI_STL_PREFETCH(addr, rw) ((void)0)
+#endif
+
 namespace mini_stl {
 template <typename T, typename Allocator = std::allocator<T>> class vector {
   public:
@@ -100,6 +115,28 @@ template <typename T, typename Allocator = std::allocator<T>> class vector {
     // erase: 删除范围 [first, last)
     iterator erase(iterator first, iterator last);
 
+    // gather：out[i] = (*this)[indices[i]]，out 被覆盖为 indices.size() 个元素
+    // out 可以是 *this 或 indices 本身
+    // 提前预取后面的元素；定义 __AVX2__ 时 4/8 字节元素使用硬件 gather；
+    // sort_batches 为 true 时每批下标排序后再访问，只在批内下标本就集中时有用，
+    // 下标分散在大数组上时排序开销反而更慢；
+    // 排序路径要求 T 可默认构造且可拷贝赋值，否则忽略 sort_batches
+    // 下标不做越界检查（同 operator[]）
+    template <typename Index>
+    void gather(const vector<Index> &indices, vector &out,
+                bool sort_batches = false) const;
+
+    // scatter：(*this)[indices[i]] = values[i]，重复下标以后写的为准
+    template <typename Index>
+    void scatter(const vector<Index> &indices, const vector &values,
+                 bool sort_batches = false);
+
+    // for_each_indexed：对每个 indices[i] 调用 f(indices[i], (*this)[indices[i]])
+    // sort_batches 为 true 时批内按下标升序调用
+    template <typename Index, typename F>
+    void for_each_indexed(const vector<Index> &indices, F &&f,
+                          bool sort_batches = false);
+
     // 获取容器大小
     size_t capacity() const { return capacity_; }
 
@@ -142,6 +179,22 @@ template <typename T, typename Allocator = std::allocator<T>> class vector {
 
     // 容量不足时扩容：翻倍策略
     void __maybe_resize();
+
+    // 预取距离（元素个数）与排序批大小
+    static constexpr size_t __prefetch_distance = 32;
+    static constexpr size_t __index_batch = 4096;
+
+    // 按 idx[first, n) 的顺序（或批内排序后）调用 visit(pos)，并预取后续元素
+    template <typename Index, typename Visit>
+    void __visit_indexed(const Index *idx, size_t first, size_t n,
+                         Visit &&visit, bool sort_batches,
+                         bool for_write) const;
+
+    // AVX2 硬件 gather，返回已处理的元素个数（不支持时返回 0）
+    template <typename Index>
+    size_t __gather_avx2(const Index *idx, T *dst, size_t n) const;
+
+    template <typename U, typename A> friend class vector;
 };
 
 // 默认构造函数
@@ -499,4 +552,182 @@ vector<T, Allocator>::erase(iterator first, iterator last) {
     size_ -= (last - first);
     return first;
 }
+
+// 下标遍历：批内可选排序，始终预取 __prefetch_distance 之后的元素
+template <typename T, typename Allocator>
+template <typename Index, typename Visit>
+void vector<T, Allocator>::__visit_indexed(const Index *idx, size_t first,
+                                           size_t n, Visit &&visit,
+                                           bool sort_batches,
+                                           bool for_write) const {
+    if (!sort_batches) {
+        size_t i = first;
+        for (; i + __prefetch_distance < n; ++i) {
+            if (for_write)
+                MINI_STL_PREFETCH(data_ + idx[i + __prefetch_distance], 1);
+            else
+                MINI_STL_PREFETCH(data_ + idx[i + __prefetch_distance], 0);
+            visit(i);
+        }
+        for (; i < n; ++i)
+            visit(i);
+        return;
+    }
+
+    // 按 (下标, 位置) 排序：重复下标保持原有先后顺序（scatter 依赖这一点）
+    vector<std::pair<Index, size_t>> order;
+    order.reserve(n - first < __index_batch ? n - first : __index_batch);
+    for (size_t b = first; b < n; b += __index_batch) {
+        size_t e = n - b < __index_batch ? n : b + __index_batch;
+        order.clear();
+        for (size_t i = b; i < e; ++i)
+            order.emplace_back(idx[i], i);
+        std::sort(order.begin(), order.end());
+
+        size_t m = e - b;
+        for (size_t k = 0; k < m; ++k) {
+            if (k + __prefetch_distance < m) {
+                const T *ahead = data_ + order[k + __prefetch_distance].first;
+                if (for_write)
+                    MINI_STL_PREFETCH(ahead, 1);
+                else
+                    MINI_STL_PREFETCH(ahead, 0);
+            }
+            visit(order[k].second);
+        }
+    }
+}
+
+// AVX2 gather：只处理 4/8 字节的平凡可复制元素与 4/8 字节整数下标
+template <typename T, typename Allocator>
+template <typename Index>
+size_t vector<T, Allocator>::__gather_avx2(const Index *idx, T *dst,
+                                           size_t n) const {
+#if defined(__AVX2__)
+    if constexpr (std::is_trivially_copyable_v<T> &&
+                  (sizeof(T) == 4 || sizeof(T) == 8) &&
+                  std::is_integral_v<Index> &&
+                  (sizeof(Index) == 4 || sizeof(Index) == 8)) {
+        // 32 位下标按有符号数解释，容器过大时退回标量路径
+        if (sizeof(Index) == 4 && size_ > size_t(INT32_MAX))
+            return 0;
+
+        constexpr size_t lanes = sizeof(Index) == 4 && sizeof(T) == 4 ? 8 : 4;
+        constexpr size_t dist = __prefetch_distance;
+        size_t i = 0;
+        for (; i + lanes <= n; i += lanes) {
+            if (i + dist + lanes <= n)
+                for (size_t l = 0; l < lanes; ++l)
+                    MINI_STL_PREFETCH(data_ + idx[i + dist + l], 0);
+
+            if constexpr (sizeof(T) == 4 && sizeof(Index) == 4) {
+                __m256i vi = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i *>(idx + i));
+                __m256i v = _mm256_i32gather_epi32(
+                    reinterpret_cast<const int *>(data_), vi, 4);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), v);
+            } else if constexpr (sizeof(T) == 4) {
+                __m256i vi = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i *>(idx + i));
+                __m128i v = _mm256_i64gather_epi32(
+                    reinterpret_cast<const int *>(data_), vi, 4);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), v);
+            } else if constexpr (sizeof(Index) == 4) {
+                __m128i vi =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(idx + i));
+                __m256i v = _mm256_i32gather_epi64(
+                    reinterpret_cast<const long long *>(data_), vi, 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), v);
+            } else {
+                __m256i vi = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i *>(idx + i));
+                __m256i v = _mm256_i64gather_epi64(
+                    reinterpret_cast<const long long *>(data_), vi, 8);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), v);
+            }
+        }
+        return i;
+    }
+#endif
+    (void)idx;
+    (void)dst;
+    (void)n;
+    return 0;
+}
+
+// gather 实现
+template <typename T, typename Allocator>
+template <typename Index>
+void vector<T, Allocator>::gather(const vector<Index> &indices, vector &out,
+                                  bool sort_batches) const {
+    // out 与源或下标是同一个对象时，先 gather 到临时 vector
+    if (&out == this || static_cast<const void *>(&out) == &indices) {
+        vector tmp;
+        gather(indices, tmp, sort_batches);
+        out = std::move(tmp);
+        return;
+    }
+
+    size_t n = indices.size();
+    const Index *idx = indices.data_;
+    out.clear();
+    out.reserve(n);
+
+    // 排序路径乱序写 out，先默认构造再赋值；不满足要求的类型走顺序路径
+    if constexpr (std::is_default_constructible_v<T> &&
+                  std::is_copy_assignable_v<T>) {
+        if (sort_batches) {
+            out.resize(n);
+            T *dst = out.data_;
+            __visit_indexed(
+                idx, 0, n, [&](size_t pos) { dst[pos] = data_[idx[pos]]; },
+                true, false);
+            return;
+        }
+    }
+
+    // 顺序路径直接在未初始化内存上构造
+    T *dst = out.data_;
+    size_t built = __gather_avx2(idx, dst, n);
+    try {
+        __visit_indexed(
+            idx, built, n,
+            [&](size_t pos) {
+                std::construct_at(dst + pos, data_[idx[pos]]);
+                ++built;
+            },
+            false, false);
+    } catch (...) {
+        for (size_t j = 0; j < built; ++j)
+            std::destroy_at(dst + j);
+        throw;
+    }
+    out.size_ = n;
+}
+
+// scatter 实现
+template <typename T, typename Allocator>
+template <typename Index>
+void vector<T, Allocator>::scatter(const vector<Index> &indices,
+                                   const vector &values, bool sort_batches) {
+    if (indices.size() != values.size())
+        throw std::invalid_argument("vector::scatter: size mismatch");
+    const Index *idx = indices.data_;
+    const T *src = values.data_;
+    __visit_indexed(
+        idx, 0, indices.size(), [&](size_t pos) { data_[idx[pos]] = src[pos]; },
+        sort_batches, true);
+}
+
+// for_each_indexed 实现
+template <typename T, typename Allocator>
+template <typename Index, typename F>
+void vector<T, Allocator>::for_each_indexed(const vector<Index> &indices,
+                                            F &&f, bool sort_batches) {
+    const Index *idx = indices.data_;
+    __visit_indexed(
+        idx, 0, indices.size(),
+        [&](size_t pos) { f(idx[pos], data_[idx[pos]]); }, sort_batches,
+        false);
+}
 } // namespace mini_stl
\ No newline at end of file
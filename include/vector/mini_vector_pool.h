@@ -0,0 +1,185 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include "mini_vector.h"
+
+namespace mini_stl {
+
+// 对象池统计信息
+struct vector_pool_stats {
+    size_t hits = 0;           // acquire 命中池中已有容量
+    size_t misses = 0;         // acquire 未命中，返回新 vector
+    size_t releases = 0;       // 被池接收并保留的次数
+    size_t drops = 0;          // 超出上限被直接释放的次数
+    size_t retained_bytes = 0; // 当前保留的总字节数
+};
+
+// vector_pool：复用 vector 容量的线程局部对象池
+// release 时只 clear()，不释放内存；acquire 时优先返回已有容量。
+// 按容量的 2 的幂划分大小类，每个大小类保留的字节数有上限。
+// 池本身不加锁，请通过 local() 在各自线程中使用。
+template <typename T, typename Allocator = std::allocator<T>>
+class vector_pool {
+  public:
+    using vector_type = mini_stl::vector<T, Allocator>;
+
+    class lease;
+
+    static constexpr size_t default_max_bytes_per_class = size_t(1) << 20;
+
+    // 构造函数：指定每个大小类最多保留的字节数
+    explicit vector_pool(
+        size_t max_bytes_per_class = default_max_bytes_per_class)
+        : max_bytes_per_class_(max_bytes_per_class) {}
+
+    vector_pool(const vector_pool &) = delete;
+    vector_pool &operator=(const vector_pool &) = delete;
+
+    // 当前线程的池
+    static vector_pool &local();
+
+    // 取出一个容量至少为 min_capacity 的空 vector
+    vector_type acquire(size_t min_capacity = 0);
+
+    // 取出并在作用域结束时自动归还
+    lease acquire_lease(size_t min_capacity = 0);
+
+    // 归还 vector：清空元素、保留容量；超出上限时直接释放
+    void release(vector_type &&vec);
+
+    // 释放所有保留的 vector
+    void trim() noexcept;
+
+    // 修改每个大小类的上限（不会立即释放已保留的部分）
+    void set_max_bytes_per_class(size_t bytes) noexcept {
+        max_bytes_per_class_ = bytes;
+    }
+    size_t max_bytes_per_class() const noexcept {
+        return max_bytes_per_class_;
+    }
+
+    // 统计信息
+    const vector_pool_stats &stats() const noexcept { return stats_; }
+    void reset_stats() noexcept;
+
+    // lease：RAII 包装，析构时归还到来源池
+    class lease {
+      public:
+        lease(vector_pool &pool, vector_type &&vec)
+            : pool_(&pool), vec_(std::move(vec)) {}
+        lease(lease &&other) noexcept
+            : pool_(std::exchange(other.pool_, nullptr)),
+              vec_(std::move(other.vec_)) {}
+        lease(const lease &) = delete;
+        lease &operator=(const lease &) = delete;
+        ~lease() {
+            if (pool_)
+                pool_->release(std::move(vec_));
+        }
+
+        vector_type &operator*() noexcept { return vec_; }
+        vector_type *operator->() noexcept { return &vec_; }
+        vector_type &get() noexcept { return vec_; }
+
+      private:
+        vector_pool *pool_;
+        vector_type vec_;
+    };
+
+  private:
+    static constexpr size_t __class_count = 64;
+
+    // 大小类 k 中每个 vector 的容量都不小于 2^k
+    std::array<mini_stl::vector<vector_type>, __class_count> buckets_;
+    std::array<size_t, __class_count> bucket_bytes_{};
+    size_t max_bytes_per_class_;
+    vector_pool_stats stats_;
+
+    // 容量所属的大小类：floor(log2(capacity))
+    static size_t __class_of(size_t capacity) noexcept {
+        return std::bit_width(capacity) - 1;
+    }
+};
+
+template <typename T, typename Allocator>
+vector_pool<T, Allocator> &vector_pool<T, Allocator>::local() {
+    thread_local vector_pool pool;
+    return pool;
+}
+
+// acquire 实现：从 floor(log2(min_capacity)) 大小类开始向上查找，
+// 该类中的 vector 容量不一定足够，需要单独检查
+template <typename T, typename Allocator>
+typename vector_pool<T, Allocator>::vector_type
+vector_pool<T, Allocator>::acquire(size_t min_capacity) {
+    for (size_t k = min_capacity ? __class_of(min_capacity) : 0;
+         k < __class_count; ++k) {
+        mini_stl::vector<vector_type> &bucket = buckets_[k];
+        if (bucket.size() == 0 || bucket.back().capacity() < min_capacity)
+            continue;
+        vector_type vec(std::move(bucket.back()));
+        bucket.erase(bucket.end() - 1);
+        bucket_bytes_[k] -= vec.capacity() * sizeof(T);
+        stats_.retained_bytes -= vec.capacity() * sizeof(T);
+        ++stats_.hits;
+        return vec;
+    }
+
+    // 未命中：容量取 2 的幂，归还后恰好落在满足同样请求的大小类
+    ++stats_.misses;
+    vector_type vec;
+    if (min_capacity)
+        vec.reserve(std::bit_ceil(min_capacity));
+    return vec;
+}
+
+template <typename T, typename Allocator>
+typename vector_pool<T, Allocator>::lease
+vector_pool<T, Allocator>::acquire_lease(size_t min_capacity) {
+    return lease(*this, acquire(min_capacity));
+}
+
+// release 实现
+template <typename T, typename Allocator>
+void vector_pool<T, Allocator>::release(vector_type &&vec) {
+    vec.clear();
+    size_t cap = vec.capacity();
+    if (cap == 0)
+        return;
+
+    size_t k = __class_of(cap);
+    size_t bytes = cap * sizeof(T);
+    if (bucket_bytes_[k] + bytes > max_bytes_per_class_) {
+        ++stats_.drops;
+        vector_type dropped(std::move(vec)); // 析构时释放
+        return;
+    }
+
+    buckets_[k].push_back(std::move(vec));
+    bucket_bytes_[k] += bytes;
+    stats_.retained_bytes += bytes;
+    ++stats_.releases;
+}
+
+// trim 实现
+template <typename T, typename Allocator>
+void vector_pool<T, Allocator>::trim() noexcept {
+    for (size_t k = 0; k < __class_count; ++k) {
+        buckets_[k].clear();
+        bucket_bytes_[k] = 0;
+    }
+    stats_.retained_bytes = 0;
+}
+
+template <typename T, typename Allocator>
+void vector_pool<T, Allocator>::reset_stats() noexcept {
+    size_t retained = stats_.retained_bytes;
+    stats_ = vector_pool_stats();
+    stats_.retained_bytes = retained;
+}
+
+} // namespace mini_stl
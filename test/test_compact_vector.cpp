@@ -0,0 +1,224 @@
+#include "vector/mini_compact_vector.h"
+#include "vector/mini_vector.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+template <typename Vec>
+void print_vector(const Vec &vec, const std::string &msg) {
+    std::cout << msg;
+    for (auto x : vec)
+        std::cout << x << " ";
+    std::cout << "(size=" << vec.size() << ", capacity=" << vec.capacity()
+              << ")\n";
+}
+
+// 统计堆上字节数的分配器（compact_vector 的块头也计入）
+static size_t g_heap_bytes = 0;
+
+template <typename T> struct byte_counting_allocator {
+    using value_type = T;
+
+    byte_counting_allocator() = default;
+    template <typename U>
+    byte_counting_allocator(const byte_counting_allocator<U> &) {}
+
+    T *allocate(size_t n) {
+        g_heap_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n) {
+        g_heap_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    bool operator==(const byte_counting_allocator &) const { return true; }
+};
+
+// 内嵌大量小 vector 的结构体
+struct record_vector {
+    std::uint32_t id;
+    mini_stl::vector<int, byte_counting_allocator<int>> tags;
+};
+
+struct record_compact {
+    std::uint32_t id;
+    mini_stl::compact_vector<int, std::uint32_t, byte_counting_allocator<int>>
+        tags;
+};
+
+// 构造 count 条记录，每条 0 ~ 4 个 tag，返回堆上字节数
+template <typename Record>
+size_t build_records(mini_stl::vector<Record> &records, size_t count) {
+    size_t before = g_heap_bytes;
+    records.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        records[i].id = static_cast<std::uint32_t>(i);
+        for (size_t t = 0; t < i % 5; ++t)
+            records[i].tags.push_back(static_cast<int>(i + t));
+    }
+    return g_heap_bytes - before;
+}
+
+// 遍历所有记录的 tags 求和，返回 (和, 毫秒)
+template <typename Record>
+std::pair<long long, double>
+scan_records(const mini_stl::vector<Record> &records) {
+    auto start = std::chrono::steady_clock::now();
+    long long sum = 0;
+    for (int round = 0; round < 10; ++round)
+        for (const Record &r : records) {
+            sum += r.tags.size();
+            for (int x : r.tags)
+                sum += x;
+        }
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> ms = end - start;
+    return {sum, ms.count()};
+}
+
+int main() {
+    // 测试对象大小
+    std::cout << "sizeof(vector<int>) = " << sizeof(mini_stl::vector<int>)
+              << "\n";
+    std::cout << "sizeof(compact_vector<int>) = "
+              << sizeof(mini_stl::compact_vector<int>) << "\n";
+    std::cout << "sizeof(record_vector) = " << sizeof(record_vector) << "\n";
+    std::cout << "sizeof(record_compact) = " << sizeof(record_compact) << "\n";
+
+    // 测试 push_back / insert 风格操作
+    mini_stl::compact_vector<int> vec;
+    print_vector(vec, "空容器: ");
+    for (int i = 0; i < 5; ++i)
+        vec.push_back(i * 10);
+    print_vector(vec, "push_back: ");
+
+    vec.emplace_back(99);
+    vec.pop_back();
+    print_vector(vec, "emplace_back + pop_back: ");
+
+    // 测试 sort 与 reverse_iterator
+    mini_stl::compact_vector<int> unsorted{30, 10, 40, 20};
+    std::sort(unsorted.begin(), unsorted.end());
+    print_vector(unsorted, "排序后: ");
+    std::cout << "反向遍历: ";
+    for (auto it = unsorted.rbegin(); it != unsorted.rend(); ++it)
+        std::cout << *it << " ";
+    std::cout << "\n";
+
+    // 测试拷贝 / 移动
+    mini_stl::compact_vector<int> copy_vec(vec);
+    print_vector(copy_vec, "拷贝构造 copy_vec: ");
+    mini_stl::compact_vector<int> move_vec(std::move(copy_vec));
+    print_vector(move_vec, "移动构造 move_vec: ");
+    print_vector(copy_vec, "被移动后 copy_vec: ");
+
+    // 测试 resize / shrink_to_fit
+    vec.resize(8, -1);
+    print_vector(vec, "resize(8, -1): ");
+    vec.resize(3);
+    vec.shrink_to_fit();
+    print_vector(vec, "resize(3) + shrink_to_fit: ");
+
+    // 测试非平凡类型与对齐
+    mini_stl::compact_vector<std::string, std::uint16_t> strs(3, "ab");
+    strs.push_back("cd");
+    print_vector(strs, "compact_vector<string, uint16_t>: ");
+
+    mini_stl::compact_vector<double> dbls{1.5, 2.5};
+    std::cout << "double 数据区对齐: "
+              << (reinterpret_cast<std::uintptr_t>(dbls.data()) %
+                      alignof(double) ==
+                  0)
+              << "\n";
+
+    // 测试 SizeType 上限
+    mini_stl::compact_vector<char, std::uint8_t> small;
+    try {
+        small.reserve(300);
+    } catch (const std::length_error &e) {
+        std::cout << "uint8_t 上限: " << e.what() << "\n";
+    }
+    for (int i = 0; i < 255; ++i)
+        small.push_back('x');
+    try {
+        small.push_back('x');
+    } catch (const std::length_error &e) {
+        std::cout << "push_back 超出 " << small.max_size() << ": " << e.what()
+                  << "\n";
+    }
+
+    // 测试容量已满时 push_back 容器内元素（参数引用旧堆块）
+    mini_stl::compact_vector<std::string> self_ref;
+    self_ref.push_back("a fairly long string that lives on the heap");
+    for (int i = 0; i < 4; ++i)
+        self_ref.push_back(self_ref[0]);
+    self_ref.emplace_back(self_ref.back());
+    std::cout << "push_back(v[0]) 后 size=" << self_ref.size()
+              << ", 内容一致: " << (self_ref.back() == self_ref.front())
+              << "\n";
+
+    // 测试扩容时 resize(n, v[0])：填充值引用旧堆块
+    mini_stl::compact_vector<std::string> self_fill;
+    self_fill.push_back(std::string(50, 'x'));
+    self_fill.resize(10, self_fill[0]);
+    std::cout << "resize(10, v[0]) 后 size=" << self_fill.size()
+              << ", 内容一致: " << (self_fill.back() == self_fill.front())
+              << "\n";
+
+    // 测试 max_size 同时受元素大小限制：uint64_t 容量不会让字节数溢出
+    mini_stl::compact_vector<int, std::uint64_t> huge;
+    try {
+        huge.reserve((SIZE_MAX >> 2) + 2);
+    } catch (const std::length_error &e) {
+        std::cout << "reserve 超出 max_size()=" << huge.max_size() << ": "
+                  << e.what() << ", capacity=" << huge.capacity() << "\n";
+    }
+
+    // 简单基准：百万条记录，各含 0 ~ 4 个 tag
+    const size_t records_count = 1 << 20;
+    mini_stl::vector<record_vector> rv;
+    mini_stl::vector<record_compact> rc;
+    size_t rv_heap = build_records(rv, records_count);
+    size_t rc_heap = build_records(rc, records_count);
+    size_t rv_total = rv_heap + records_count * sizeof(record_vector);
+    size_t rc_total = rc_heap + records_count * sizeof(record_compact);
+    std::cout << records_count << " 条 record_vector: 堆 " << rv_heap
+              << " 字节, 合计 " << rv_total << " 字节\n";
+    std::cout << records_count << " 条 record_compact: 堆 " << rc_heap
+              << " 字节（含块头）, 合计 " << rc_total << " 字节\n";
+    auto [rv_sum, rv_ms] = scan_records(rv);
+    auto [rc_sum, rc_ms] = scan_records(rc);
+    std::cout << "遍历 record_vector: " << rv_ms << " ms\n";
+    std::cout << "遍历 record_compact: " << rc_ms << " ms\n";
+    std::cout << "求和一致: " << (rv_sum == rc_sum) << "\n";
+
+    // 简单基准：单个大 vector 遍历求和
+    const size_t n = 1 << 22;
+    mini_stl::vector<int> plain;
+    mini_stl::compact_vector<int> compact;
+    for (size_t i = 0; i < n; ++i) {
+        plain.push_back(static_cast<int>(i));
+        compact.push_back(static_cast<int>(i));
+    }
+
+    auto bench = [](const auto &v) {
+        auto start = std::chrono::steady_clock::now();
+        long long sum = 0;
+        for (int round = 0; round < 10; ++round)
+            for (int x : v)
+                sum += x;
+        auto end = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::milli> ms = end - start;
+        return std::make_pair(sum, ms.count());
+    };
+    auto [plain_sum, plain_ms] = bench(plain);
+    auto [compact_sum, compact_ms] = bench(compact);
+    std::cout << "遍历 vector: " << plain_ms << " ms\n";
+    std::cout << "遍历 compact_vector: " << compact_ms << " ms\n";
+    std::cout << "求和一致: " << (plain_sum == compact_sum) << "\n";
+
+    return 0;
+}
@@ -0,0 +1,178 @@
+#include "vector/mini_packed_int_vector.h"
+#include "vector/mini_vector.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+
+int main() {
+    // 测试小规模：只在尾块中
+    mini_stl::packed_int_vector small{5, 3, 9};
+    std::cout << "尾块: ";
+    small.for_each([](std::uint64_t v) { std::cout << v << " "; });
+    std::cout << "(size=" << small.size() << ")\n";
+
+    // 构造三类数据：有序小差值、随机大值、常量
+    const size_t n = 1 << 21;
+    std::mt19937_64 rng(42);
+    mini_stl::vector<std::uint64_t> sorted_ids, random_vals, constant;
+    std::uint64_t id = 1000000;
+    for (size_t i = 0; i < n; ++i) {
+        id += rng() % 16;
+        sorted_ids.push_back(id);
+        random_vals.push_back(rng());
+        constant.push_back(7);
+    }
+
+    auto check = [](const mini_stl::vector<std::uint64_t> &src,
+                    const char *name) {
+        mini_stl::packed_int_vector packed(src.begin(), src.end());
+        bool ok = packed.size() == src.size();
+        // 随机访问
+        for (size_t i = 0; ok && i < src.size(); i += 37)
+            ok = packed[i] == src[i];
+        ok = ok && packed.at(src.size() - 1) == src.back();
+        // 整体解码
+        mini_stl::vector<std::uint64_t> out;
+        packed.decode(out);
+        for (size_t i = 0; ok && i < src.size(); ++i)
+            ok = out[i] == src[i];
+        std::cout << name << ": 正确=" << ok << ", 压缩后 "
+                  << packed.memory_bytes() << " 字节 / 原始 "
+                  << src.size() * sizeof(std::uint64_t) << " 字节\n";
+        return packed;
+    };
+    mini_stl::packed_int_vector packed_ids = check(sorted_ids, "有序 ID");
+    check(random_vals, "随机值");
+    check(constant, "常量");
+
+    // 测试边界：块边界与尾块
+    mini_stl::packed_int_vector edge;
+    for (std::uint64_t i = 0; i < 300; ++i)
+        edge.push_back(i * i);
+    std::cout << "块边界: edge[127]=" << edge[127] << ", edge[128]=" << edge[128]
+              << ", edge[299]=" << edge[299]
+              << ", block_count=" << edge.block_count() << "\n";
+    try {
+        edge.at(300);
+    } catch (const std::out_of_range &e) {
+        std::cout << "at 越界: " << e.what() << "\n";
+    }
+
+    // 编码选择计入检查点：差分位宽只比 FOR 小 1 时，delta 块反而更大，应选 FOR
+    // 有序块最大差值 63（6 位）、跨度 127（7 位），与打乱后只能用 FOR 的块大小相同
+    mini_stl::vector<std::uint64_t> near_sorted, near_shuffled;
+    std::uint64_t near = 0;
+    for (size_t j = 0; j < 128; ++j) {
+        near += j == 0 ? 0 : (j == 1 ? 63 : (j <= 65 ? 1 : 0));
+        near_sorted.push_back(near);
+    }
+    for (size_t j = 0; j < 128; ++j)
+        near_shuffled.push_back(near_sorted[(j * 37) % 128]);
+    mini_stl::packed_int_vector near_a(near_sorted.begin(), near_sorted.end());
+    mini_stl::packed_int_vector near_b(near_shuffled.begin(),
+                                       near_shuffled.end());
+    std::cout << "差分位宽只小 1 时选 FOR: "
+              << (near_a.memory_bytes() == near_b.memory_bytes() &&
+                  near_a[127] == 127)
+              << "\n";
+
+    // 逐位宽测试：FOR 位宽 1 ~ 64，delta 位宽 1 ~ 24，逐值与随机访问都要一致
+    size_t width_errors = 0;
+    for (unsigned w = 1; w <= 64; ++w) {
+        std::uint64_t mask = w == 64 ? ~std::uint64_t(0)
+                                     : (std::uint64_t(1) << w) - 1;
+        mini_stl::vector<std::uint64_t> for_vals, delta_vals;
+        std::uint64_t cur = rng() >> 8;
+        for (size_t i = 0; i < 3 * 128 + 5; ++i) {
+            for_vals.push_back(12345 + (rng() & mask));
+            cur += rng() & (w <= 24 ? mask : 0xFFFFFF);
+            delta_vals.push_back(cur);
+        }
+        for (const auto *src : {&for_vals, &delta_vals}) {
+            mini_stl::packed_int_vector packed(src->begin(), src->end());
+            mini_stl::vector<std::uint64_t> out;
+            packed.decode(out);
+            for (size_t i = 0; i < src->size(); ++i)
+                width_errors += (out[i] != (*src)[i]) + (packed[i] != (*src)[i]);
+        }
+    }
+    std::cout << "逐位宽错误个数: " << width_errors << "\n";
+
+    auto time_ms = [](auto &&fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::milli> ms = end - start;
+        return ms.count();
+    };
+
+    // 简单基准：求和扫描（数据放得进缓存）
+    const int rounds = 20;
+    std::uint64_t plain_sum = 0, packed_sum = 0;
+    double plain_ms = time_ms([&] {
+        for (int r = 0; r < rounds; ++r)
+            for (std::uint64_t v : sorted_ids)
+                plain_sum += v;
+    });
+    double packed_ms = time_ms([&] {
+        for (int r = 0; r < rounds; ++r)
+            packed_ids.for_each_block(
+                [&](const std::uint64_t *values, size_t m) {
+                    for (size_t j = 0; j < m; ++j)
+                        packed_sum += values[j];
+                });
+    });
+    std::cout << "扫描 vector<uint64_t>: " << plain_ms << " ms\n";
+    std::cout << "扫描 packed_int_vector: " << packed_ms << " ms\n";
+    std::cout << "求和一致: " << (plain_sum == packed_sum) << "\n";
+
+    // 简单基准：随机访问（delta 块从检查点累加）
+    const size_t probes = 1 << 22;
+    mini_stl::vector<std::uint32_t> probe_idx;
+    for (size_t i = 0; i < probes; ++i)
+        probe_idx.push_back(static_cast<std::uint32_t>(rng() % n));
+    std::uint64_t plain_rand = 0, packed_rand = 0;
+    double plain_rand_ms = time_ms([&] {
+        for (std::uint32_t i : probe_idx)
+            plain_rand += sorted_ids[i];
+    });
+    double packed_rand_ms = time_ms([&] {
+        for (std::uint32_t i : probe_idx)
+            packed_rand += packed_ids[i];
+    });
+    std::cout << "随机访问 vector<uint64_t>: " << plain_rand_ms * 1e6 / probes
+              << " ns/次\n";
+    std::cout << "随机访问 packed_int_vector: "
+              << packed_rand_ms * 1e6 / probes << " ns/次\n";
+    std::cout << "随机访问结果一致: " << (plain_rand == packed_rand) << "\n";
+
+    // 简单基准：16M 个有序 ID（128 MB，超出缓存）单趟扫描
+    const size_t big_n = 1 << 24;
+    mini_stl::vector<std::uint64_t> big_ids;
+    big_ids.reserve(big_n);
+    for (size_t i = 0; i < big_n; ++i) {
+        id += rng() % 16;
+        big_ids.push_back(id);
+    }
+    mini_stl::packed_int_vector big_packed(big_ids.begin(), big_ids.end());
+    std::uint64_t big_plain_sum = 0, big_packed_sum = 0;
+    double big_plain_ms = time_ms([&] {
+        for (std::uint64_t v : big_ids)
+            big_plain_sum += v;
+    });
+    double big_packed_ms = time_ms([&] {
+        big_packed.for_each_block([&](const std::uint64_t *values, size_t m) {
+            for (size_t j = 0; j < m; ++j)
+                big_packed_sum += values[j];
+        });
+    });
+    std::cout << "16M 有序 ID 压缩后 " << big_packed.memory_bytes()
+              << " 字节 / 原始 " << big_n * sizeof(std::uint64_t) << " 字节\n";
+    std::cout << "扫描超出缓存的 vector<uint64_t>: " << big_plain_ms << " ms\n";
+    std::cout << "扫描超出缓存的 packed_int_vector: " << big_packed_ms
+              << " ms\n";
+    std::cout << "求和一致: " << (big_plain_sum == big_packed_sum) << "\n";
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+#include "vector/mini_persistent_vector.h"
+#include "vector/mini_vector.h"
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <string>
+
+void print_vector(const mini_stl::persistent_vector<int> &vec,
+                  const std::string &msg) {
+    std::cout << msg;
+    for (auto x : vec)
+        std::cout << x << " ";
+    std::cout << "(size=" << vec.size() << ")\n";
+}
+
+// 检查 vec[i] == i * k
+bool check_linear(const mini_stl::persistent_vector<int> &vec, int k) {
+    size_t i = 0;
+    for (int x : vec) {
+        if (x != static_cast<int>(i) * k || vec[i] != x)
+            return false;
+        ++i;
+    }
+    return i == vec.size();
+}
+
+int main() {
+    // 测试 push_back 与快照
+    mini_stl::persistent_vector<int> vec{0, 10, 20};
+    mini_stl::persistent_vector<int> snap = vec;
+    vec.push_back(30);
+    vec.set(0, -1);
+    print_vector(vec, "修改后 vec: ");
+    print_vector(snap, "快照 snap: ");
+
+    // 测试多层树（超过 32 * 32 + 32 个元素触发根节点加层）
+    mini_stl::persistent_vector<int> big;
+    const int n = 40000;
+    for (int i = 0; i < n; ++i)
+        big.push_back(i);
+    std::cout << "逐个 push_back " << n << " 个元素: " << check_linear(big, 1)
+              << "\n";
+
+    // 在快照上修改：原版本不受影响
+    mini_stl::persistent_vector<int> big_snap = big;
+    big.set(5, 0);
+    big.set(n - 1, 0);
+    big.push_back(n);
+    std::cout << "快照不受影响: " << check_linear(big_snap, 1)
+              << ", 修改后 big[5]=" << big[5] << ", big.back()=" << big.back()
+              << ", size=" << big.size() << "\n";
+
+    // 测试 transient 批量构建
+    mini_stl::transient_vector<int> builder;
+    for (int i = 0; i < n; ++i)
+        builder.push_back(i);
+    for (int i = 0; i < n; ++i)
+        builder.set(i, builder[i] * 2);
+    mini_stl::persistent_vector<int> doubled = builder.persistent();
+    std::cout << "transient 构建: " << check_linear(doubled, 2) << "\n";
+
+    // persistent() 之后继续使用 builder 不会影响已冻结的快照
+    builder.set(0, 12345);
+    builder.push_back(-1);
+    std::cout << "冻结后继续修改 builder: doubled[0]=" << doubled[0]
+              << ", builder[0]=" << builder[0]
+              << ", builder.size()=" << builder.size() << "\n";
+
+    // 从快照开启 transient：共享节点会被复制而不是原地修改
+    mini_stl::transient_vector<int> editor = doubled.transient();
+    editor.set(100, 0);
+    mini_stl::persistent_vector<int> edited = editor.persistent();
+    std::cout << "transient 不改动源快照: " << check_linear(doubled, 2)
+              << ", edited[100]=" << edited[100] << "\n";
+
+    // 测试 transient 移动：可从具名局部变量返回、交给其他对象
+    auto make_builder = [](int count) {
+        mini_stl::transient_vector<int> b;
+        for (int i = 0; i < count; ++i)
+            b.push_back(i);
+        return b;
+    };
+    mini_stl::transient_vector<int> moved = make_builder(100);
+    mini_stl::transient_vector<int> target;
+    target = std::move(moved);
+    moved.push_back(-5); // 源对象变为空 transient，修改不影响 target
+    target.set(0, 7);
+    std::cout << "transient 移动: target.size()=" << target.size()
+              << ", target[0]=" << target[0] << ", target[99]=" << target[99]
+              << ", moved.size()=" << moved.size() << "\n";
+
+    // 测试越界
+    try {
+        vec.at(100);
+    } catch (const std::out_of_range &e) {
+        std::cout << "at 越界: " << e.what() << "\n";
+    }
+
+    // 测试非平凡类型
+    mini_stl::persistent_vector<std::string> strs{"a", "b"};
+    auto strs_snap = strs;
+    strs.set(1, "B");
+    std::cout << "string: " << strs[1] << " / 快照 " << strs_snap[1] << "\n";
+
+    // 简单基准：拷贝快照
+    const int rounds = 1000;
+    mini_stl::vector<int> plain;
+    for (int i = 0; i < n; ++i)
+        plain.push_back(i);
+
+    auto start = std::chrono::steady_clock::now();
+    size_t total = 0;
+    for (int r = 0; r < rounds; ++r) {
+        mini_stl::vector<int> copy(plain);
+        total += copy.size();
+    }
+    auto mid = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        mini_stl::persistent_vector<int> copy(doubled);
+        total += copy.size();
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> plain_ms = mid - start;
+    std::chrono::duration<double, std::milli> pers_ms = end - mid;
+    std::cout << rounds << " 次拷贝 vector: " << plain_ms.count() << " ms\n";
+    std::cout << rounds << " 次拷贝 persistent_vector: " << pers_ms.count()
+              << " ms\n";
+    std::cout << "元素总数: " << total << "\n";
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+#include "vector/mini_vector.h"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+
+// 没有默认构造函数的类型：gather 的排序路径不可用，退回顺序构造
+struct no_default {
+    explicit no_default(int v) : value(v) {}
+    int value;
+};
+
+template <typename T>
+void print_vector(const mini_stl::vector<T> &vec, const std::string &msg) {
+    std::cout << msg;
+    for (const auto &x : vec)
+        std::cout << x << " ";
+    std::cout << "\n";
+}
+
+template <typename T, typename Index>
+bool check_gather(const mini_stl::vector<T> &src,
+                  const mini_stl::vector<Index> &idx,
+                  const mini_stl::vector<T> &out) {
+    if (out.size() != idx.size())
+        return false;
+    for (size_t i = 0; i < idx.size(); ++i)
+        if (out[i] != src[idx[i]])
+            return false;
+    return true;
+}
+
+int main() {
+    // 测试小规模 gather / scatter / for_each_indexed
+    mini_stl::vector<int> vec;
+    for (int i = 0; i < 10; ++i)
+        vec.push_back(i * 10);
+    mini_stl::vector<std::uint32_t> idx;
+    for (std::uint32_t i : {7u, 2u, 2u, 9u, 0u})
+        idx.push_back(i);
+
+    mini_stl::vector<int> out;
+    vec.gather(idx, out);
+    print_vector(out, "gather(7 2 2 9 0): ");
+
+    mini_stl::vector<int> vals;
+    for (int v : {-7, -2, -22, -9, 0})
+        vals.push_back(v);
+    vec.scatter(idx, vals, true);
+    print_vector(vec, "scatter（重复下标以后写的为准）: ");
+
+    long long visited = 0;
+    vec.for_each_indexed(idx, [&](std::uint32_t i, int &v) {
+        v += 1;
+        visited += i;
+    });
+    print_vector(vec, "for_each_indexed(+1): ");
+    std::cout << "访问下标之和: " << visited << "\n";
+
+    // gather 到自身
+    vec.gather(idx, vec);
+    print_vector(vec, "gather 到自身: ");
+
+    // gather 到下标本身（out 与 indices 是同一个对象）
+    mini_stl::vector<size_t> perm_src, self_idx, expect;
+    for (size_t i = 0; i < 50; ++i) {
+        perm_src.push_back(i * 3);
+        self_idx.push_back((i * 7) % 50);
+    }
+    for (size_t i = 0; i < 50; ++i)
+        expect.push_back(perm_src[self_idx[i]]);
+    mini_stl::vector<size_t> self_idx2(self_idx);
+    perm_src.gather(self_idx, self_idx, true);
+    perm_src.gather(self_idx2, self_idx2);
+    size_t wrong = 0;
+    for (size_t i = 0; i < 50; ++i)
+        wrong += (self_idx[i] != expect[i]) + (self_idx2[i] != expect[i]);
+    std::cout << "gather 到下标本身错误个数: " << wrong << "\n";
+
+    // 测试非平凡类型
+    mini_stl::vector<std::string> strs;
+    for (const char *s : {"a", "b", "c"})
+        strs.push_back(s);
+    mini_stl::vector<size_t> sidx;
+    for (size_t i : {2, 0, 1, 2})
+        sidx.push_back(i);
+    mini_stl::vector<std::string> sout;
+    strs.gather(sidx, sout, true);
+    print_vector(sout, "string gather（排序批）: ");
+
+    mini_stl::vector<no_default> nds;
+    for (int i = 0; i < 3; ++i)
+        nds.emplace_back(i * 100);
+    mini_stl::vector<no_default> nd_out;
+    nds.gather(sidx, nd_out, true);
+    std::cout << "无默认构造类型 gather: ";
+    for (const no_default &x : nd_out)
+        std::cout << x.value << " ";
+    std::cout << "\n";
+
+    // 测试 size 不一致
+    try {
+        mini_stl::vector<int> short_vals;
+        vec.scatter(idx, short_vals);
+    } catch (const std::invalid_argument &e) {
+        std::cout << "scatter 长度不一致: " << e.what() << "\n";
+    }
+
+    // 大规模正确性：4 种元素 / 下标宽度组合
+    const size_t n = 1 << 24;
+    const size_t m = 1 << 22;
+    std::mt19937_64 rng(7);
+    mini_stl::vector<std::uint32_t> big32;
+    mini_stl::vector<std::uint64_t> big64;
+    mini_stl::vector<std::uint32_t> idx32;
+    mini_stl::vector<std::uint64_t> idx64;
+    for (size_t i = 0; i < n; ++i) {
+        big32.push_back(static_cast<std::uint32_t>(rng()));
+        big64.push_back(rng());
+    }
+    for (size_t i = 0; i < m; ++i) {
+        std::uint64_t r = rng() % n;
+        idx32.push_back(static_cast<std::uint32_t>(r));
+        idx64.push_back(r);
+    }
+
+    mini_stl::vector<std::uint32_t> out32;
+    mini_stl::vector<std::uint64_t> out64;
+    big32.gather(idx32, out32);
+    bool ok = check_gather(big32, idx32, out32);
+    big32.gather(idx64, out32);
+    ok = ok && check_gather(big32, idx64, out32);
+    big64.gather(idx32, out64);
+    ok = ok && check_gather(big64, idx32, out64);
+    big64.gather(idx64, out64, true);
+    ok = ok && check_gather(big64, idx64, out64);
+    std::cout << "大规模 gather 正确: " << ok << "\n";
+
+    // 简单基准：普通下标循环 / gather / 排序批 gather
+    auto time_ms = [](auto &&fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        std::chrono::duration<double, std::milli> ms = end - start;
+        return ms.count();
+    };
+
+    mini_stl::vector<std::uint64_t> plain_out(m);
+    double plain_ms = time_ms([&] {
+        for (size_t i = 0; i < m; ++i)
+            plain_out[i] = big64[idx64[i]];
+    });
+    double gather_ms = time_ms([&] { big64.gather(idx64, out64); });
+    double sorted_ms = time_ms([&] { big64.gather(idx64, out64, true); });
+    std::cout << "普通下标循环: " << plain_ms << " ms\n";
+    std::cout << "gather: " << gather_ms << " ms\n";
+    std::cout << "gather（排序批）: " << sorted_ms << " ms\n";
+
+    double plain_scatter_ms = time_ms([&] {
+        for (size_t i = 0; i < m; ++i)
+            big64[idx64[i]] = plain_out[i];
+    });
+    double scatter_ms = time_ms([&] { big64.scatter(idx64, plain_out); });
+    std::cout << "普通下标写入: " << plain_scatter_ms << " ms\n";
+    std::cout << "scatter: " << scatter_ms << " ms\n";
+
+    return 0;
+}
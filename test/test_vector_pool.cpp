@@ -0,0 +1,107 @@
+#include "vector/mini_vector_pool.h"
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+
+// 统计 allocate 次数的分配器
+static size_t g_allocations = 0;
+
+template <typename T> struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() = default;
+    template <typename U> counting_allocator(const counting_allocator<U> &) {}
+
+    T *allocate(size_t n) {
+        ++g_allocations;
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T *p, size_t n) { std::allocator<T>().deallocate(p, n); }
+
+    bool operator==(const counting_allocator &) const { return true; }
+};
+
+using counted_vector = mini_stl::vector<int, counting_allocator<int>>;
+using counted_pool = mini_stl::vector_pool<int, counting_allocator<int>>;
+
+void print_stats(const counted_pool &pool, const char *msg) {
+    const mini_stl::vector_pool_stats &s = pool.stats();
+    std::cout << msg << "hits=" << s.hits << ", misses=" << s.misses
+              << ", releases=" << s.releases << ", drops=" << s.drops
+              << ", retained_bytes=" << s.retained_bytes << "\n";
+}
+
+// 模拟一次请求：取 vector、填充、归还
+void handle_request(counted_pool &pool, int n) {
+    counted_vector vec = pool.acquire(n);
+    for (int i = 0; i < n; ++i)
+        vec.push_back(i);
+    pool.release(std::move(vec));
+}
+
+int main() {
+    counted_pool &pool = counted_pool::local();
+
+    // 预热：第一次请求会分配
+    handle_request(pool, 1000);
+    print_stats(pool, "预热后: ");
+
+    // 稳态：不再分配
+    size_t before = g_allocations;
+    for (int r = 0; r < 1000; ++r)
+        handle_request(pool, 1000);
+    std::cout << "稳态 1000 次请求的分配次数: " << g_allocations - before
+              << "\n";
+    print_stats(pool, "稳态后: ");
+
+    // 测试 lease：作用域结束自动归还
+    {
+        auto lease = pool.acquire_lease(10);
+        lease->push_back(42);
+        std::cout << "lease 容量: " << lease->capacity()
+                  << ", size: " << lease->size() << "\n";
+    }
+    print_stats(pool, "lease 归还后: ");
+
+    // 测试大小类上限：超过上限的 vector 被直接释放
+    counted_pool bounded(4096);
+    for (int i = 0; i < 4; ++i) {
+        counted_vector vec;
+        vec.reserve(512); // 2048 字节
+        bounded.release(std::move(vec));
+    }
+    print_stats(bounded, "上限 4096 字节: ");
+
+    // 测试 trim
+    bounded.trim();
+    print_stats(bounded, "trim 之后: ");
+
+    // 简单基准：池化与直接构造
+    const int rounds = 100000;
+    const int n = 256;
+    auto start = std::chrono::steady_clock::now();
+    long long sum = 0;
+    for (int r = 0; r < rounds; ++r) {
+        counted_vector vec;
+        for (int i = 0; i < n; ++i)
+            vec.push_back(i);
+        sum += vec.size();
+    }
+    auto mid = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r) {
+        counted_vector vec = pool.acquire(n);
+        for (int i = 0; i < n; ++i)
+            vec.push_back(i);
+        sum += vec.size();
+        pool.release(std::move(vec));
+    }
+    auto end = std::chrono::steady_clock::now();
+    std::chrono::duration<double, std::milli> plain_ms = mid - start;
+    std::chrono::duration<double, std::milli> pool_ms = end - mid;
+    std::cout << "直接构造: " << plain_ms.count() << " ms\n";
+    std::cout << "池化复用: " << pool_ms.count() << " ms\n";
+    std::cout << "元素总数: " << sum << "\n";
+
+    return 0;
+}